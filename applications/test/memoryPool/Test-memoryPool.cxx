@@ -0,0 +1,137 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2026 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-memoryPool
+
+Description
+    Reuse of list storage through the memoryPool, and the time for
+    repeatedly creating and destroying mesh-sized field temporaries with
+    and without the pool.
+
+\*---------------------------------------------------------------------------*/
+
+#include "memoryPool.H"
+#include "memInfo.H"
+#include "IOstreams.H"
+#include "DynamicList.H"
+#include "scalarField.H"
+#include "vectorField.H"
+#include "clockTime.H"
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+// Time step like churn of field temporaries
+scalar churn(const label n, const label nIter)
+{
+    const scalarField a(n, 1.0);
+    const vectorField b(n, vector::one);
+
+    scalar sum = 0;
+
+    clockTime timer;
+
+    for (label iter = 0; iter < nIter; ++iter)
+    {
+        tmp<scalarField> tc = a*a + 2*a;
+        tmp<vectorField> td = (tc()*b) - b;
+        sum += tc()[iter % n] + td()[iter % n].x();
+    }
+
+    const scalar elapsed = timer.elapsedTime();
+
+    Info<< "    (checksum " << sum << ")" << nl;
+
+    return elapsed;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+//  Main program:
+
+int main(int argc, char *argv[])
+{
+    const label n = 1000000;
+    const label nIter = 200;
+
+    memoryPool::active_ = 0;
+    Info<< "system allocator: " << nl;
+    const scalar systemTime = churn(n, nIter);
+
+    memoryPool::active_ = 1;
+    Info<< "memory pool: " << nl;
+    const scalar poolTime = churn(n, nIter);
+
+    Info<< "time system: " << systemTime
+        << " pool: " << poolTime << nl << nl;
+
+    // Storage handed between lists and dynamic lists of different
+    // addressable size
+    {
+        DynamicList<scalar> dynList;
+        for (label i = 0; i < n; ++i)
+        {
+            dynList.push_back(i);
+        }
+        dynList.resize(10);
+
+        scalarList list;
+        list.transfer(dynList);
+
+        Info<< "transferred list: " << list.size() << nl;
+
+        DynamicList<label> small(10, Zero);
+        small.reserve(n);
+        small.clear();
+    }
+
+    // Small lists are not pooled
+    {
+        labelList small(100, Zero);
+        Info<< "small list: " << small.size() << nl;
+    }
+
+    // Not trivially destructible, never pooled
+    {
+        List<scalarList> lists(10, scalarList(n, Zero));
+        Info<< "list of lists: " << lists.size() << nl;
+    }
+
+    memoryPool::writeEntry("memoryPool", Info);
+
+    memoryPool::clear();
+    memoryPool::writeEntry("memoryPool", Info);
+
+    memInfo mem;
+    mem.writeEntry("memory", Info);
+    Info<< endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
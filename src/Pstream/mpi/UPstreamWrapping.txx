@@ -6,7 +6,7 @@
      \\/     M anipulation  |
 -------------------------------------------------------------------------------
     Copyright (C) 2012-2015 OpenFOAM Foundation
-    Copyright (C) 2019-2023 OpenCFD Ltd.
+    Copyright (C) 2019-2026 OpenCFD Ltd.
 -------------------------------------------------------------------------------
 License
     This file is part of OpenFOAM.
@@ -47,6 +47,8 @@ void Foam::PstreamDetail::broadcast0
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     profilingPstream::beginTiming();
 
     // const int returnCode =
@@ -78,6 +80,8 @@ void Foam::PstreamDetail::reduce0
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     if (UPstream::warnComm >= 0 && comm != UPstream::warnComm)
     {
         Pout<< "** MPI_Reduce (blocking):";
@@ -134,6 +138,8 @@ void Foam::PstreamDetail::allReduce
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     if (UPstream::warnComm >= 0 && comm != UPstream::warnComm)
     {
         if (immediate)
@@ -277,6 +283,8 @@ void Foam::PstreamDetail::allToAll
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
 
 #if defined(MPI_VERSION) && (MPI_VERSION >= 3)
     if (immediate)
@@ -424,6 +432,8 @@ void Foam::PstreamDetail::allToAllv
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
 
 #if defined(MPI_VERSION) && (MPI_VERSION >= 3)
     if (immediate)
@@ -544,6 +554,8 @@ void Foam::PstreamDetail::allToAllConsensus
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     // Fake send/recv for myself
     {
         recvData[myProci] = sendData[myProci];
@@ -744,6 +756,8 @@ void Foam::PstreamDetail::allToAllConsensus
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
 
     // ------------------------------------------------------------------------
     // Setup sends
@@ -910,6 +924,8 @@ void Foam::PstreamDetail::gather
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     const label numProc = UPstream::nProcs(comm);
 
     if (UPstream::warnComm >= 0 && comm != UPstream::warnComm)
@@ -1017,6 +1033,8 @@ void Foam::PstreamDetail::scatter
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     const label numProc = UPstream::nProcs(comm);
 
     if (UPstream::warnComm >= 0 && comm != UPstream::warnComm)
@@ -1125,6 +1143,8 @@ void Foam::PstreamDetail::gatherv
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     const label np = UPstream::nProcs(comm);
 
     if (UPstream::warnComm >= 0 && comm != UPstream::warnComm)
@@ -1267,6 +1287,8 @@ void Foam::PstreamDetail::scatterv
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     const label np = UPstream::nProcs(comm);
 
     if (UPstream::warnComm >= 0 && comm != UPstream::warnComm)
@@ -1395,6 +1417,8 @@ void Foam::PstreamDetail::allGather
         return;
     }
 
+    PstreamGlobals::finishSharedSends();
+
     if (UPstream::warnComm >= 0 && comm != UPstream::warnComm)
     {
         if (immediate)